@@ -0,0 +1,220 @@
+// Localhost latency benchmark for the NAG socket settings.
+//
+// Each iteration opens a fresh connection and POSTs a certificate-sized JSON
+// body, exactly like the transport in CepAccount does, and records the round
+// trip time. Every option is measured on its own and then as part of the
+// predefined profiles, reporting p50/p99 per variant. Rows for options that
+// cannot take effect on this host are flagged instead of silently reporting
+// the baseline.
+//
+// Usage: socket_profile_benchmark [iterations] [payload_bytes]
+
+#include <circular/socket_profile.hpp>
+#include <httplib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct Variant {
+    std::string name;
+    circular::SocketSettings settings;
+};
+
+/// Parses a non-negative integer argument, returning false on malformed or out-of-range input
+bool parse_argument(const char* text, long long min_value, long long max_value, long long& value) {
+    try {
+        size_t consumed = 0;
+        value = std::stoll(text, &consumed);
+        return consumed == std::strlen(text) && value >= min_value && value <= max_value;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+struct Stats {
+    double p50_us;
+    double p99_us;
+    size_t failures;
+};
+
+double percentile(std::vector<double>& samples, double p) {
+    if (samples.empty()) {
+        return 0.0;
+    }
+    auto index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+    return samples[index];
+}
+
+Stats run_variant(int port, const circular::SocketSettings& settings, int iterations, const std::string& body) {
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(iterations));
+    size_t failures = 0;
+
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+
+        httplib::Client client("127.0.0.1", port);
+        client.set_socket_options([&settings](httplib::socket_t sock) {
+            circular::apply_socket_settings(static_cast<circular::native_socket_t>(sock), settings);
+        });
+        auto response = client.Post("/certify", body, "application/json");
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        if (!response || response->status != 200) {
+            ++failures;
+            continue;
+        }
+        samples.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+    }
+
+    Stats stats;
+    stats.p50_us = percentile(samples, 0.50);
+    stats.p99_us = percentile(samples, 0.99);
+    stats.failures = failures;
+    return stats;
+}
+
+/// Returns net.ipv4.tcp_fastopen, or -1 if it cannot be read (non-Linux hosts)
+int read_fastopen_sysctl() {
+    std::ifstream sysctl("/proc/sys/net/ipv4/tcp_fastopen");
+    int value = -1;
+    if (!(sysctl >> value)) {
+        return -1;
+    }
+    return value;
+}
+
+/// Explains why a variant cannot show an effect on this host, or returns an empty string
+std::string ineffective_reason(const circular::SocketSettings& settings, int fastopen_sysctl) {
+    std::string reason;
+    // Over loopback both ends are local, so Fast Open needs client (0x1) and server (0x2) bits
+    if (settings.tcp_fast_open && (fastopen_sysctl < 0 || (fastopen_sysctl & 0x3) != 0x3)) {
+        reason += "tcp_fast_open needs net.ipv4.tcp_fastopen=3";
+    }
+    // Loopback has no NAPI and httplib waits in poll(), which SO_BUSY_POLL does not affect
+    if (settings.busy_poll_usec > 0) {
+        if (!reason.empty()) {
+            reason += "; ";
+        }
+        reason += "busy_poll has no effect on loopback";
+    }
+    return reason;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long long iterations_arg = 2000;
+    long long payload_arg = 1024;
+    if ((argc > 1 && !parse_argument(argv[1], 1, 10000000, iterations_arg)) ||
+        (argc > 2 && !parse_argument(argv[2], 0, 64 * 1024 * 1024, payload_arg))) {
+        std::cerr << "Usage: " << argv[0] << " [iterations (1-10000000)] [payload_bytes (0-67108864)]" << std::endl;
+        return 1;
+    }
+    int iterations = static_cast<int>(iterations_arg);
+    size_t payload_bytes = static_cast<size_t>(payload_arg);
+
+    // Certificate-sized request body; the response mirrors a NAG acknowledgement
+    std::string body = "{\"Payload\":\"" + std::string(payload_bytes, 'A') + "\"}";
+
+    httplib::Server server;
+    server.set_tcp_nodelay(true);
+    server.set_socket_options([](httplib::socket_t sock) {
+        int yes = 1;
+        setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&yes), sizeof(yes));
+#ifdef TCP_FASTOPEN
+        // Accept data in the SYN; needs bit 2 of net.ipv4.tcp_fastopen on Linux
+        int queue_length = 256;
+        setsockopt(sock, IPPROTO_TCP, TCP_FASTOPEN, reinterpret_cast<const char*>(&queue_length), sizeof(queue_length));
+#endif
+    });
+    server.Post("/certify", [](const httplib::Request&, httplib::Response& res) {
+        res.set_content("{\"Result\":200,\"Response\":\"ok\"}", "application/json");
+    });
+
+    int port = server.bind_to_any_port("127.0.0.1");
+    if (port < 0) {
+        std::cerr << "Failed to bind benchmark server" << std::endl;
+        return 1;
+    }
+    std::thread server_thread([&server]() { server.listen_after_bind(); });
+    while (!server.is_running()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    circular::SocketSettings nodelay;
+    nodelay.tcp_nodelay = true;
+
+    circular::SocketSettings fast_open;
+    fast_open.tcp_fast_open = true;
+
+    circular::SocketSettings buffers;
+    buffers.send_buffer_bytes = 256 * 1024;
+    buffers.receive_buffer_bytes = 256 * 1024;
+
+    circular::SocketSettings busy_poll;
+    busy_poll.busy_poll_usec = 50;
+
+    std::vector<Variant> variants = {
+        {"default", circular::SocketSettings{}},
+        {"tcp_nodelay", nodelay},
+        {"tcp_fast_open", fast_open},
+        {"buffers_256k", buffers},
+        {"busy_poll_50us", busy_poll},
+        {"profile_throughput", circular::SocketSettings::for_profile(circular::SocketProfile::Throughput)},
+        {"profile_low_latency", circular::SocketSettings::for_profile(circular::SocketProfile::LowLatency)},
+    };
+
+    int fastopen_sysctl = read_fastopen_sysctl();
+    std::cout << "iterations=" << iterations << " payload_bytes=" << payload_bytes
+              << " net.ipv4.tcp_fastopen=" << fastopen_sysctl << "\n";
+    std::printf("%-22s %12s %12s %9s %s\n", "variant", "p50_us", "p99_us", "failures", "note");
+
+    for (const auto& variant : variants) {
+        // Probe on a throwaway socket which options the kernel rejects or caps
+        std::string skipped_options;
+#ifndef _WIN32
+        int probe = socket(AF_INET, SOCK_STREAM, 0);
+        if (probe >= 0) {
+            circular::apply_socket_settings(probe, variant.settings, &skipped_options);
+            close(probe);
+        }
+#endif
+        std::string note = "ok";
+        std::string reason = ineffective_reason(variant.settings, fastopen_sysctl);
+        if (!reason.empty()) {
+            note = "not effective on this host: " + reason;
+        }
+        if (!skipped_options.empty()) {
+            note += " (not applied: " + skipped_options + ")";
+        }
+
+        // Warm up, which also primes the Fast Open cookie cache for 127.0.0.1
+        run_variant(port, variant.settings, std::max(1, iterations / 20), body);
+
+        Stats stats = run_variant(port, variant.settings, iterations, body);
+        std::printf("%-22s %12.1f %12.1f %9zu %s\n", variant.name.c_str(), stats.p50_us, stats.p99_us,
+                    stats.failures, note.c_str());
+    }
+
+    server.stop();
+    server_thread.join();
+    return 0;
+}
@@ -5,6 +5,7 @@
 
 #include <string>
 #include <nlohmann/json.hpp>
+#include <circular/utils.hpp>
 
 namespace circular {
 
@@ -51,6 +52,27 @@ public:
     /// @return A string containing the decoded data
     std::string get_data() const;
 
+    /// @brief Sets the data content of the certificate in encrypted form
+    ///
+    /// The data is encrypted with AES-256-GCM and hex-encoded in a single
+    /// streaming pass; the stored value is the hex envelope
+    /// nonce || ciphertext || tag. Use get_confidential_data() to read it back.
+    ///
+    /// @param data A string containing the plaintext to be set
+    /// @param key_hex The 32-byte encryption key as a hex string
+    /// @return true if the data was encrypted and stored, false if the key is
+    ///         invalid or encryption fails (the stored data is left unchanged)
+    bool set_confidential_data(const std::string& data, const std::string& key_hex);
+
+    /// @brief Decrypts and authenticates the data content of the certificate
+    ///
+    /// @param key_hex The 32-byte encryption key as a hex string
+    /// @return A Result<std::string, std::string> which is:
+    ///         - Ok(String) containing the original plaintext
+    ///         - Err(String) if the key is wrong, the data was not set with
+    ///           set_confidential_data(), or it has been tampered with
+    Result<std::string, std::string> get_confidential_data(const std::string& key_hex) const;
+
     /// @brief Returns the JSON string representation of the certificate
     ///
     /// This method serializes the CCertificate object into a JSON string.
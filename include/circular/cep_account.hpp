@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <nlohmann/json.hpp>
 #include <circular/utils.hpp>
+#include <circular/socket_profile.hpp>
 
 namespace circular {
 
@@ -71,6 +72,16 @@ public:
     /// @param blockchain_address A string representing the blockchain identifier
     void set_blockchain(const std::string& blockchain_address);
 
+    /// @brief Selects a predefined socket tuning profile for requests to the NAG
+    ///
+    /// Replaces socket_settings with the settings of the given profile. Use
+    /// SocketProfile::LowLatency for single latency-critical certifications and
+    /// SocketProfile::Throughput for bulk submissions. Options the platform
+    /// rejects are reported by get_socket_warning().
+    ///
+    /// @param profile The socket profile to use
+    void set_socket_profile(SocketProfile profile);
+
     /// @brief Updates the account's nonce by querying the network
     ///
     /// This asynchronous method sends a request to the network to retrieve
@@ -96,6 +107,22 @@ public:
     ///         (check get_last_error() to see if an error occurred)
     Task<void> submit_certificate(const std::string& pdata, const std::string& private_key_hex);
 
+    /// @brief Submits an encrypted certificate to the Circular network
+    ///
+    /// Behaves like submit_certificate(), but the data is encrypted with
+    /// AES-256-GCM before being anchored. Encryption, payload hex encoding and
+    /// transaction ID hashing are fused into one streaming pass over pdata, so
+    /// no separate ciphertext copy is made. Read the data back with
+    /// decrypt_confidential() on the payload's "Data" field.
+    ///
+    /// @param pdata A string containing the plaintext payload data for the certificate
+    /// @param private_key_hex A string containing the private key in hexadecimal format
+    /// @param encryption_key_hex The 32-byte AES-256 key as a hex string
+    /// @return A Task<void> that completes when the submission finishes
+    ///         (check get_last_error() to see if an error occurred)
+    Task<void> submit_confidential_certificate(const std::string& pdata, const std::string& private_key_hex,
+                                               const std::string& encryption_key_hex);
+
     /// @brief Retrieves a transaction from the network by its block ID and transaction ID
     ///
     /// This asynchronous method queries the network for a specific transaction.
@@ -130,6 +157,16 @@ public:
     ///         or std::nullopt if there was no recent error
     std::optional<std::string> get_last_error() const;
 
+    /// @brief Retrieves the socket options that could not be applied on the last NAG request
+    ///
+    /// Socket settings are applied best effort, so a skipped option does not
+    /// fail the request or set last_error. This reports, e.g., Fast Open on a
+    /// platform without support or a buffer size capped by the kernel.
+    ///
+    /// @return An std::optional<std::string> listing the skipped options,
+    ///         or std::nullopt if every requested option was applied
+    std::optional<std::string> get_socket_warning() const;
+
     // Public fields (matching Rust implementation)
 
     /// @brief The hexadecimal address of the account
@@ -162,6 +199,9 @@ public:
     /// @brief The base URL for network discovery
     std::string network_url;
 
+    /// @brief Socket options applied to every connection opened towards the NAG
+    SocketSettings socket_settings;
+
 private:
     /// @brief Optional additional information about the account, typically in JSON format
     std::optional<nlohmann::json> info_;
@@ -169,6 +209,9 @@ private:
     /// @brief Stores the last encountered error message, if any, during account operations
     std::optional<std::string> last_error_;
 
+    /// @brief Socket options that could not be applied on the last NAG request, if any
+    std::optional<std::string> socket_warning_;
+
     /// @brief Signs a message using the account's private key
     ///
     /// This method takes a message and a hexadecimal private key, then uses
@@ -183,6 +226,19 @@ private:
     ///           the private key is invalid, or the signing process fails
     Result<std::string, std::string> sign_data(const std::string& message, const std::string& private_key_hex) const;
 
+    /// @brief Signs a prepared certificate transaction and sends it to the network
+    ///
+    /// Shared tail of submit_certificate and submit_confidential_certificate.
+    /// Runs synchronously on the caller's thread and updates latest_tx_id,
+    /// nonce and last_error.
+    ///
+    /// @param id The hex transaction ID computed over the payload
+    /// @param payload The hex-encoded transaction payload
+    /// @param timestamp The timestamp that was included in the ID hash
+    /// @param private_key_hex A string containing the private key in hexadecimal format
+    void send_certificate(const std::string& id, const std::string& payload, const std::string& timestamp,
+                          const std::string& private_key_hex);
+
     /// @brief Retrieves a transaction by its ID within a specified block range
     ///
     /// This method constructs and sends a request to the network to fetch transaction
@@ -8,7 +8,9 @@
 
 #include <circular/cep_account.hpp>
 #include <circular/ccertificate.hpp>
+#include <circular/confidential.hpp>
 #include <circular/utils.hpp>
+#include <circular/socket_profile.hpp>
 #include <circular/env_loader.hpp>
 
 /// @namespace circular
@@ -0,0 +1,101 @@
+#pragma once
+
+/// @file confidential.hpp
+/// @brief Confidential (AES-256-GCM encrypted) certificate data for Circular Protocol Enterprise APIs
+
+#include <string>
+#include <cstddef>
+#include <functional>
+#include <circular/utils.hpp>
+
+namespace circular {
+
+/// @brief Size in bytes of a confidential certificate key (AES-256)
+inline constexpr std::size_t CONFIDENTIAL_KEY_SIZE = 32;
+
+/// @brief Size in bytes of the random GCM nonce prepended to the ciphertext
+inline constexpr std::size_t CONFIDENTIAL_NONCE_SIZE = 12;
+
+/// @brief Size in bytes of the GCM authentication tag appended to the ciphertext
+inline constexpr std::size_t CONFIDENTIAL_TAG_SIZE = 16;
+
+/// @brief Receives consecutive pieces of an encrypted envelope as they are produced
+///
+/// The sink is called with the nonce, then the ciphertext in chunks, then the
+/// authentication tag. Concatenating every piece yields the full envelope.
+/// Returning false aborts the encryption.
+using ConfidentialSink = std::function<bool(const unsigned char* bytes, std::size_t length)>;
+
+/// @brief Payload and transaction ID produced by encode_confidential_payload
+struct ConfidentialPayload {
+    /// @brief The hex-encoded transaction payload, ready for the "Payload" field
+    std::string payload;
+
+    /// @brief The lowercase hex SHA-256 transaction ID
+    std::string id;
+};
+
+/// @brief Generates a new random confidential certificate key
+///
+/// @return A 64-character uppercase hex string holding a 32-byte AES-256 key,
+///         or an empty string if the random number generator fails
+std::string generate_confidential_key();
+
+/// @brief Encrypts data with AES-256-GCM, streaming the envelope into a sink
+///
+/// The envelope layout is nonce (12 bytes) || ciphertext || tag (16 bytes).
+/// A fresh random nonce is drawn for every call. Encryption goes through
+/// OpenSSL EVP, which dispatches to AES-NI/PCLMULQDQ when the CPU supports them.
+/// The input is processed in fixed-size chunks so callers can encode or hash
+/// each piece without materialising a separate ciphertext buffer.
+///
+/// @param data The plaintext to encrypt
+/// @param key_hex The 32-byte key as a hex string (with or without "0x" prefix)
+/// @param sink Callback receiving each piece of the envelope in order
+/// @return A Result<bool, std::string> which is:
+///         - Ok(true) if the whole envelope was delivered to the sink
+///         - Err(String) if the key is invalid, encryption fails or the sink returns false
+Result<bool, std::string> encrypt_confidential_stream(const std::string& data, const std::string& key_hex,
+                                                      const ConfidentialSink& sink);
+
+/// @brief Encrypts data with AES-256-GCM and returns the envelope as hex
+///
+/// @param data The plaintext to encrypt
+/// @param key_hex The 32-byte key as a hex string
+/// @return A Result<std::string, std::string> which is:
+///         - Ok(String) containing the uppercase hex envelope
+///         - Err(String) if the key is invalid or encryption fails
+Result<std::string, std::string> encrypt_confidential(const std::string& data, const std::string& key_hex);
+
+/// @brief Decrypts and authenticates a hex-encoded AES-256-GCM envelope
+///
+/// The hex input is decoded and decrypted in a single streaming pass. The
+/// plaintext is only returned once the authentication tag has been verified.
+///
+/// @param hex_data The hex envelope (nonce || ciphertext || tag), with or without "0x" prefix
+/// @param key_hex The 32-byte key as a hex string
+/// @return A Result<std::string, std::string> which is:
+///         - Ok(String) containing the original plaintext
+///         - Err(String) if the key or envelope is malformed, or authentication fails
+Result<std::string, std::string> decrypt_confidential(const std::string& hex_data, const std::string& key_hex);
+
+/// @brief Builds an encrypted certificate payload and its transaction ID in one pass
+///
+/// Produces exactly what submit_certificate would produce for the encrypted
+/// envelope, i.e. str_to_hex of {"Action":"CP_CERTIFICATE","Data":str_to_hex(envelope)},
+/// together with sha256(id_prefix + payload + id_suffix). Each ciphertext chunk is
+/// expanded straight into its double-hex form and fed to the hash while still in
+/// cache, so neither the ciphertext nor the intermediate JSON is ever stored.
+///
+/// @param data The plaintext document
+/// @param key_hex The 32-byte key as a hex string
+/// @param id_prefix The part of the hashed string preceding the payload
+/// @param id_suffix The part of the hashed string following the payload
+/// @return A Result<ConfidentialPayload, std::string> which is:
+///         - Ok(ConfidentialPayload) containing the payload and transaction ID
+///         - Err(String) if the key is invalid or encryption fails
+Result<ConfidentialPayload, std::string> encode_confidential_payload(const std::string& data, const std::string& key_hex,
+                                                                     const std::string& id_prefix,
+                                                                     const std::string& id_suffix);
+
+} // namespace circular
@@ -0,0 +1,100 @@
+#pragma once
+
+/// @file socket_profile.hpp
+/// @brief Socket tuning profiles for the Network Access Gateway (NAG) transport
+
+#include <cstdint>
+#include <string>
+
+namespace circular {
+
+/// @brief Native socket handle type (SOCKET on Windows, file descriptor elsewhere)
+#ifdef _WIN32
+using native_socket_t = std::uintptr_t;
+#else
+using native_socket_t = int;
+#endif
+
+/// @brief Predefined socket tuning profiles
+enum class SocketProfile {
+    /// @brief Operating system defaults; no options are changed
+    Default,
+
+    /// @brief TCP Fast Open with Nagle left on, for bulk submissions over many fresh connections
+    Throughput,
+
+    /// @brief TCP Fast Open and NODELAY, for single latency-critical requests
+    LowLatency
+};
+
+/// @brief Socket options applied to every connection opened towards the NAG
+///
+/// A value of false or 0 leaves the corresponding option at the operating
+/// system default, so a default-constructed SocketSettings changes nothing.
+struct SocketSettings {
+    /// @brief Disables Nagle's algorithm (TCP_NODELAY)
+    bool tcp_nodelay = false;
+
+    /// @brief Sends the first request bytes in the SYN (TCP_FASTOPEN_CONNECT, Linux only)
+    ///
+    /// The kernel caches the Fast Open cookie per destination, so the first
+    /// connection to a NAG pays the normal handshake and later ones skip a round trip.
+    bool tcp_fast_open = false;
+
+    /// @brief Send buffer size in bytes (SO_SNDBUF), 0 for the system default
+    ///
+    /// A fixed size disables the kernel's buffer autotuning and is capped at
+    /// net.core.wmem_max; a capped value is reported as not applied.
+    int send_buffer_bytes = 0;
+
+    /// @brief Receive buffer size in bytes (SO_RCVBUF), 0 for the system default
+    ///
+    /// A fixed size disables the kernel's buffer autotuning and is capped at
+    /// net.core.rmem_max; a capped value is reported as not applied.
+    int receive_buffer_bytes = 0;
+
+    /// @brief Busy-poll budget in microseconds for blocking reads (SO_BUSY_POLL, Linux only), 0 to disable
+    ///
+    /// Only affects blocking recv() on NAPI devices. The HTTP transport waits in
+    /// poll()/select(), which is governed by the net.core.busy_poll sysctl instead,
+    /// so this is not part of any profile. Values above net.core.busy_read
+    /// require CAP_NET_ADMIN.
+    int busy_poll_usec = 0;
+
+    /// @brief Enables TCP keepalive probes (SO_KEEPALIVE)
+    ///
+    /// Only useful on long-lived connections; the NAG transport opens a new
+    /// connection per request, so this is not part of any profile.
+    bool keepalive = false;
+
+    /// @brief Idle time in seconds before the first keepalive probe, 0 for the system default
+    int keepalive_idle_sec = 0;
+
+    /// @brief Interval in seconds between keepalive probes, 0 for the system default
+    int keepalive_interval_sec = 0;
+
+    /// @brief Number of unanswered probes before the connection is dropped, 0 for the system default
+    int keepalive_count = 0;
+
+    /// @brief Returns the settings for a predefined profile
+    ///
+    /// @param profile The profile to look up
+    /// @return The SocketSettings making up that profile
+    static SocketSettings for_profile(SocketProfile profile);
+};
+
+/// @brief Applies socket settings to an unconnected socket
+///
+/// Options are applied best effort: an option that the platform does not
+/// support or that the process lacks privileges for is skipped and the
+/// remaining options are still applied.
+///
+/// @param sock The socket to configure, before connect() is called
+/// @param settings The settings to apply
+/// @param skipped_options If not null, receives a comma-separated list of the
+///        options that were skipped or capped by the kernel
+/// @return true if every requested option was applied, false if any was skipped
+bool apply_socket_settings(native_socket_t sock, const SocketSettings& settings,
+                           std::string* skipped_options = nullptr);
+
+} // namespace circular
@@ -1,6 +1,7 @@
 #include <circular/ccertificate.hpp>
 #include <circular/circular_enterprise_apis.hpp>
 #include <circular/utils.hpp>
+#include <circular/confidential.hpp>
 
 namespace circular {
 
@@ -25,6 +26,26 @@ std::string CCertificate::get_data() const {
     return hex_to_str(data_);
 }
 
+/// @brief Encrypts and stores the data content of the certificate
+/// @param data A string containing the plaintext to store
+/// @param key_hex The 32-byte encryption key as a hex string
+/// @return true on success, false if encryption fails
+bool CCertificate::set_confidential_data(const std::string& data, const std::string& key_hex) {
+    auto result = encrypt_confidential(data, key_hex);
+    if (!result.has_value()) {
+        return false;
+    }
+    data_ = std::move(result.value());
+    return true;
+}
+
+/// @brief Decrypts the certificate's data content
+/// @param key_hex The 32-byte encryption key as a hex string
+/// @return A Result containing the plaintext, or an error if authentication fails
+Result<std::string, std::string> CCertificate::get_confidential_data(const std::string& key_hex) const {
+    return decrypt_confidential(data_, key_hex);
+}
+
 /// @brief Generates a JSON string representation of the certificate
 /// @return A JSON-formatted string, or empty string on serialization error
 std::string CCertificate::get_json_certificate() const {
@@ -1,6 +1,7 @@
 #include <circular/cep_account.hpp>
 #include <circular/circular_enterprise_apis.hpp>
 #include <circular/utils.hpp>
+#include <circular/confidential.hpp>
 
 #include <secp256k1.h>
 #include <openssl/sha.h>
@@ -65,9 +66,15 @@ namespace {
         /// @brief Performs an async POST request with JSON data
         /// @param url The HTTPS URL to request
         /// @param data The JSON data to send in the request body
+        /// @param settings Socket options applied to the connection before it is opened
+        /// @param socket_warning Output parameter set to the socket options that could not be
+        ///        applied, or std::nullopt if all were applied
         /// @return Task that resolves to Result containing parsed JSON response or error message
-        static Task<Result<nlohmann::json, std::string>> post_json(const std::string& url, const nlohmann::json& data) {
-            return std::async(std::launch::async, [url, data]() -> Result<nlohmann::json, std::string> {
+        static Task<Result<nlohmann::json, std::string>> post_json(const std::string& url, const nlohmann::json& data,
+                                                                   const SocketSettings& settings,
+                                                                   std::optional<std::string>* socket_warning) {
+            return std::async(std::launch::async, [url, data, settings, socket_warning]() -> Result<nlohmann::json, std::string> {
+                *socket_warning = std::nullopt;
                 try {
                     // Parse URL to extract host and path
                     std::string host, path;
@@ -78,10 +85,19 @@ namespace {
                     httplib::Client client(("https://" + host).c_str());
                     client.set_connection_timeout(30, 0);
                     client.set_read_timeout(30, 0);
+                    std::string skipped_options;
+                    client.set_socket_options([&settings, &skipped_options](httplib::socket_t sock) {
+                        skipped_options.clear();
+                        apply_socket_settings(static_cast<native_socket_t>(sock), settings, &skipped_options);
+                    });
 
                     std::string json_str = data.dump();
                     auto response = client.Post(path.c_str(), json_str, "application/json");
 
+                    if (!skipped_options.empty()) {
+                        *socket_warning = "socket options not applied: " + skipped_options;
+                    }
+
                     if (!response) {
                         return Result<nlohmann::json, std::string>::Err("network request failed");
                     }
@@ -141,8 +157,10 @@ CepAccount::CepAccount()
     , nonce(0)
     , interval_sec(2)
     , network_url(DEFAULT_NETWORK_URL)
+    , socket_settings()
     , info_(std::nullopt)
     , last_error_(std::nullopt)
+    , socket_warning_(std::nullopt)
 {
 }
 
@@ -185,6 +203,10 @@ void CepAccount::set_blockchain(const std::string& blockchain_address) {
     blockchain = blockchain_address;
 }
 
+void CepAccount::set_socket_profile(SocketProfile profile) {
+    socket_settings = SocketSettings::for_profile(profile);
+}
+
 Task<bool> CepAccount::update_account() {
     return std::async(std::launch::async, [this]() -> bool {
         if (address.empty()) {
@@ -199,7 +221,7 @@ Task<bool> CepAccount::update_account() {
         };
 
         std::string url = nag_url + "Circular_GetWalletNonce_" + network_node;
-        auto result = NetworkClient::post_json(url, request_data).get();
+        auto result = NetworkClient::post_json(url, request_data, socket_settings, &socket_warning_).get();
 
         if (!result.has_value()) {
             last_error_ = result.error();
@@ -326,51 +348,79 @@ Task<void> CepAccount::submit_certificate(const std::string& pdata, const std::s
         auto hash = sha256(str_to_hash);
         std::string id = bytes_to_hex(hash);
 
-        // Sign the ID
-        auto signature_result = sign_data(id, private_key_hex);
-        if (!signature_result.has_value()) {
-            last_error_ = "failed to sign data: " + signature_result.error();
+        send_certificate(id, payload, timestamp, private_key_hex);
+    });
+}
+
+Task<void> CepAccount::submit_confidential_certificate(const std::string& pdata, const std::string& private_key_hex,
+                                                       const std::string& encryption_key_hex) {
+    return std::async(std::launch::async, [this, pdata, private_key_hex, encryption_key_hex]() -> void {
+        if (address.empty()) {
+            last_error_ = "Account is not open";
             return;
         }
 
-        // Create request data
-        nlohmann::json request_data = {
-            {"ID", id},
-            {"From", hex_fix(address)},
-            {"To", hex_fix(address)},
-            {"Timestamp", timestamp},
-            {"Payload", payload},
-            {"Nonce", std::to_string(nonce)},
-            {"Signature", signature_result.value()},
-            {"Blockchain", hex_fix(blockchain)},
-            {"Type", "C_TYPE_CERTIFICATE"},
-            {"Version", code_version}
-        };
-
-        // Submit to network
-        std::string url = nag_url + "Circular_AddTransaction_" + network_node;
-        auto result = NetworkClient::post_json(url, request_data).get();
+        std::string timestamp = get_formatted_timestamp();
 
-        if (!result.has_value()) {
-            last_error_ = result.error();
+        // Encrypt, encode and hash in one pass; the ID covers the same fields as submit_certificate
+        auto encoded = encode_confidential_payload(pdata, encryption_key_hex,
+                                                   hex_fix(blockchain) + hex_fix(address) + hex_fix(address),
+                                                   std::to_string(nonce) + timestamp);
+        if (!encoded.has_value()) {
+            last_error_ = "failed to encrypt data: " + encoded.error();
             return;
         }
 
-        auto data = result.value();
-        if (data.contains("Result") && data["Result"].is_number_integer()) {
-            int result_code = data["Result"];
-            if (result_code == 200) {
-                latest_tx_id = id;
-                nonce += 1;
+        send_certificate(encoded.value().id, encoded.value().payload, timestamp, private_key_hex);
+    });
+}
+
+void CepAccount::send_certificate(const std::string& id, const std::string& payload, const std::string& timestamp,
+                                  const std::string& private_key_hex) {
+    // Sign the ID
+    auto signature_result = sign_data(id, private_key_hex);
+    if (!signature_result.has_value()) {
+        last_error_ = "failed to sign data: " + signature_result.error();
+        return;
+    }
+
+    // Create request data
+    nlohmann::json request_data = {
+        {"ID", id},
+        {"From", hex_fix(address)},
+        {"To", hex_fix(address)},
+        {"Timestamp", timestamp},
+        {"Payload", payload},
+        {"Nonce", std::to_string(nonce)},
+        {"Signature", signature_result.value()},
+        {"Blockchain", hex_fix(blockchain)},
+        {"Type", "C_TYPE_CERTIFICATE"},
+        {"Version", code_version}
+    };
+
+    // Submit to network
+    std::string url = nag_url + "Circular_AddTransaction_" + network_node;
+    auto result = NetworkClient::post_json(url, request_data, socket_settings, &socket_warning_).get();
+
+    if (!result.has_value()) {
+        last_error_ = result.error();
+        return;
+    }
+
+    auto data = result.value();
+    if (data.contains("Result") && data["Result"].is_number_integer()) {
+        int result_code = data["Result"];
+        if (result_code == 200) {
+            latest_tx_id = id;
+            nonce += 1;
+        } else {
+            if (data.contains("Response") && data["Response"].is_string()) {
+                last_error_ = "certificate submission failed: " + data["Response"].get<std::string>();
             } else {
-                if (data.contains("Response") && data["Response"].is_string()) {
-                    last_error_ = "certificate submission failed: " + data["Response"].get<std::string>();
-                } else {
-                    last_error_ = "certificate submission failed with non-200 result code";
-                }
+                last_error_ = "certificate submission failed with non-200 result code";
             }
         }
-    });
+    }
 }
 
 Task<std::optional<nlohmann::json>> CepAccount::get_transaction(const std::string& block_id, const std::string& transaction_id) {
@@ -413,7 +463,7 @@ Task<Result<nlohmann::json, std::string>> CepAccount::get_transaction_by_id(cons
         };
 
         std::string url = nag_url + "Circular_GetTransactionbyID_" + network_node;
-        auto network_result = NetworkClient::post_json(url, request_data).get();
+        auto network_result = NetworkClient::post_json(url, request_data, socket_settings, &socket_warning_).get();
         if (network_result.has_value()) {
             return Result<nlohmann::json, std::string>::Ok(network_result.value());
         } else {
@@ -468,4 +518,8 @@ std::optional<std::string> CepAccount::get_last_error() const {
     return last_error_;
 }
 
+std::optional<std::string> CepAccount::get_socket_warning() const {
+    return socket_warning_;
+}
+
 } // namespace circular
\ No newline at end of file
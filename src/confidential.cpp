@@ -0,0 +1,319 @@
+#include <circular/confidential.hpp>
+#include <circular/utils.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace circular {
+
+namespace {
+    /// @brief Number of plaintext bytes processed per cipher update
+    constexpr std::size_t CHUNK_SIZE = 16 * 1024;
+
+    constexpr char UPPER_HEX[] = "0123456789ABCDEF";
+    constexpr char LOWER_HEX[] = "0123456789abcdef";
+
+    struct CipherCtxDeleter {
+        void operator()(EVP_CIPHER_CTX* ctx) const { EVP_CIPHER_CTX_free(ctx); }
+    };
+    using CipherCtxPtr = std::unique_ptr<EVP_CIPHER_CTX, CipherCtxDeleter>;
+
+    struct DigestCtxDeleter {
+        void operator()(EVP_MD_CTX* ctx) const { EVP_MD_CTX_free(ctx); }
+    };
+    using DigestCtxPtr = std::unique_ptr<EVP_MD_CTX, DigestCtxDeleter>;
+
+    /// @brief Converts a single hex digit to its value
+    /// @param c The character to convert
+    /// @return The digit value (0-15), or -1 if c is not a hex digit
+    int hex_value(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    /// @brief Decodes exactly `count` bytes from a hex character sequence
+    /// @param hex Pointer to at least 2 * count hex characters
+    /// @param count Number of bytes to decode
+    /// @param out Destination buffer of at least count bytes
+    /// @return true on success, false if a non-hex character was found
+    bool decode_hex(const char* hex, std::size_t count, unsigned char* out) {
+        for (std::size_t i = 0; i < count; ++i) {
+            int hi = hex_value(hex[2 * i]);
+            int lo = hex_value(hex[2 * i + 1]);
+            if (hi < 0 || lo < 0) {
+                return false;
+            }
+            out[i] = static_cast<unsigned char>((hi << 4) | lo);
+        }
+        return true;
+    }
+
+    /// @brief Appends the uppercase hex representation of bytes to a string
+    /// @param out The string to append to
+    /// @param bytes The bytes to encode
+    /// @param length Number of bytes to encode
+    void append_hex(std::string& out, const unsigned char* bytes, std::size_t length) {
+        std::size_t pos = out.size();
+        out.resize(pos + 2 * length);
+        char* p = out.data() + pos;
+        for (std::size_t i = 0; i < length; ++i) {
+            *p++ = UPPER_HEX[bytes[i] >> 4];
+            *p++ = UPPER_HEX[bytes[i] & 0x0F];
+        }
+    }
+
+    /// @brief Parses a hex AES-256 key
+    ///
+    /// The key is decoded in place rather than through hex_fix(), which would
+    /// pad a mistyped odd-length key and leave unwiped copies behind.
+    ///
+    /// @param key_hex The key as a hex string (with or without "0x" prefix)
+    /// @param key Output buffer of CONFIDENTIAL_KEY_SIZE bytes, wiped on failure
+    /// @return true if the key is exactly 32 bytes of valid hex
+    bool parse_key(const std::string& key_hex, unsigned char* key) {
+        std::size_t start = 0;
+        if (key_hex.length() >= 2 && key_hex[0] == '0' && (key_hex[1] == 'x' || key_hex[1] == 'X')) {
+            start = 2;
+        }
+        if (key_hex.length() - start != 2 * CONFIDENTIAL_KEY_SIZE) {
+            return false;
+        }
+        if (!decode_hex(key_hex.data() + start, CONFIDENTIAL_KEY_SIZE, key)) {
+            OPENSSL_cleanse(key, CONFIDENTIAL_KEY_SIZE);
+            return false;
+        }
+        return true;
+    }
+}
+
+std::string generate_confidential_key() {
+    unsigned char key[CONFIDENTIAL_KEY_SIZE];
+    if (RAND_bytes(key, static_cast<int>(sizeof(key))) != 1) {
+        return "";
+    }
+    std::string key_hex;
+    append_hex(key_hex, key, sizeof(key));
+    OPENSSL_cleanse(key, sizeof(key));
+    return key_hex;
+}
+
+Result<bool, std::string> encrypt_confidential_stream(const std::string& data, const std::string& key_hex,
+                                                      const ConfidentialSink& sink) {
+    unsigned char key[CONFIDENTIAL_KEY_SIZE];
+    if (!parse_key(key_hex, key)) {
+        return Result<bool, std::string>::Err("confidential key must be 32 bytes of hex");
+    }
+
+    unsigned char nonce[CONFIDENTIAL_NONCE_SIZE];
+    if (RAND_bytes(nonce, static_cast<int>(sizeof(nonce))) != 1) {
+        OPENSSL_cleanse(key, sizeof(key));
+        return Result<bool, std::string>::Err("failed to generate nonce");
+    }
+
+    CipherCtxPtr ctx(EVP_CIPHER_CTX_new());
+    bool initialized = ctx &&
+        EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_gcm(), nullptr, nullptr, nullptr) == 1 &&
+        EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(sizeof(nonce)), nullptr) == 1 &&
+        EVP_EncryptInit_ex(ctx.get(), nullptr, nullptr, key, nonce) == 1;
+    OPENSSL_cleanse(key, sizeof(key));
+    if (!initialized) {
+        return Result<bool, std::string>::Err("failed to initialize AES-256-GCM");
+    }
+
+    if (!sink(nonce, sizeof(nonce))) {
+        return Result<bool, std::string>::Err("envelope sink failed");
+    }
+
+    // GCM is a stream mode, so each update emits exactly as many bytes as it consumes
+    unsigned char out[CHUNK_SIZE];
+    const auto* in = reinterpret_cast<const unsigned char*>(data.data());
+    for (std::size_t offset = 0; offset < data.size(); offset += CHUNK_SIZE) {
+        std::size_t chunk = std::min(CHUNK_SIZE, data.size() - offset);
+        int out_len = 0;
+        if (EVP_EncryptUpdate(ctx.get(), out, &out_len, in + offset, static_cast<int>(chunk)) != 1) {
+            return Result<bool, std::string>::Err("encryption failed");
+        }
+        if (!sink(out, static_cast<std::size_t>(out_len))) {
+            return Result<bool, std::string>::Err("envelope sink failed");
+        }
+    }
+
+    int final_len = 0;
+    if (EVP_EncryptFinal_ex(ctx.get(), out, &final_len) != 1) {
+        return Result<bool, std::string>::Err("encryption failed");
+    }
+    if (final_len > 0 && !sink(out, static_cast<std::size_t>(final_len))) {
+        return Result<bool, std::string>::Err("envelope sink failed");
+    }
+
+    unsigned char tag[CONFIDENTIAL_TAG_SIZE];
+    if (EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_GET_TAG, static_cast<int>(sizeof(tag)), tag) != 1) {
+        return Result<bool, std::string>::Err("failed to compute authentication tag");
+    }
+    if (!sink(tag, sizeof(tag))) {
+        return Result<bool, std::string>::Err("envelope sink failed");
+    }
+
+    return Result<bool, std::string>::Ok(true);
+}
+
+Result<std::string, std::string> encrypt_confidential(const std::string& data, const std::string& key_hex) {
+    std::string envelope_hex;
+    envelope_hex.reserve(2 * (CONFIDENTIAL_NONCE_SIZE + data.size() + CONFIDENTIAL_TAG_SIZE));
+
+    auto result = encrypt_confidential_stream(data, key_hex, [&envelope_hex](const unsigned char* bytes, std::size_t length) {
+        append_hex(envelope_hex, bytes, length);
+        return true;
+    });
+    if (!result.has_value()) {
+        return Result<std::string, std::string>::Err(result.error());
+    }
+    return Result<std::string, std::string>::Ok(std::move(envelope_hex));
+}
+
+Result<std::string, std::string> decrypt_confidential(const std::string& hex_data, const std::string& key_hex) {
+    unsigned char key[CONFIDENTIAL_KEY_SIZE];
+    if (!parse_key(key_hex, key)) {
+        return Result<std::string, std::string>::Err("confidential key must be 32 bytes of hex");
+    }
+
+    // Skip an optional "0x" prefix without copying the envelope
+    std::size_t start = 0;
+    if (hex_data.length() >= 2 && hex_data[0] == '0' && (hex_data[1] == 'x' || hex_data[1] == 'X')) {
+        start = 2;
+    }
+    const char* hex = hex_data.data() + start;
+    std::size_t hex_len = hex_data.length() - start;
+
+    if (hex_len % 2 != 0 || hex_len / 2 < CONFIDENTIAL_NONCE_SIZE + CONFIDENTIAL_TAG_SIZE) {
+        OPENSSL_cleanse(key, sizeof(key));
+        return Result<std::string, std::string>::Err("malformed confidential envelope");
+    }
+    std::size_t ciphertext_len = hex_len / 2 - CONFIDENTIAL_NONCE_SIZE - CONFIDENTIAL_TAG_SIZE;
+    const char* ciphertext_hex = hex + 2 * CONFIDENTIAL_NONCE_SIZE;
+
+    unsigned char nonce[CONFIDENTIAL_NONCE_SIZE];
+    unsigned char tag[CONFIDENTIAL_TAG_SIZE];
+    if (!decode_hex(hex, sizeof(nonce), nonce) ||
+        !decode_hex(ciphertext_hex + 2 * ciphertext_len, sizeof(tag), tag)) {
+        OPENSSL_cleanse(key, sizeof(key));
+        return Result<std::string, std::string>::Err("malformed confidential envelope");
+    }
+
+    CipherCtxPtr ctx(EVP_CIPHER_CTX_new());
+    bool initialized = ctx &&
+        EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_gcm(), nullptr, nullptr, nullptr) == 1 &&
+        EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_SET_IVLEN, static_cast<int>(sizeof(nonce)), nullptr) == 1 &&
+        EVP_DecryptInit_ex(ctx.get(), nullptr, nullptr, key, nonce) == 1;
+    OPENSSL_cleanse(key, sizeof(key));
+    if (!initialized) {
+        return Result<std::string, std::string>::Err("failed to initialize AES-256-GCM");
+    }
+
+    // Decode each hex chunk into a small buffer and decrypt it straight into the output
+    std::string plaintext(ciphertext_len, '\0');
+    auto* out = reinterpret_cast<unsigned char*>(plaintext.data());
+    unsigned char in[CHUNK_SIZE];
+    std::size_t written = 0;
+    for (std::size_t offset = 0; offset < ciphertext_len; offset += CHUNK_SIZE) {
+        std::size_t chunk = std::min(CHUNK_SIZE, ciphertext_len - offset);
+        int out_len = 0;
+        if (!decode_hex(ciphertext_hex + 2 * offset, chunk, in)) {
+            OPENSSL_cleanse(plaintext.data(), plaintext.size());
+            return Result<std::string, std::string>::Err("malformed confidential envelope");
+        }
+        if (EVP_DecryptUpdate(ctx.get(), out + written, &out_len, in, static_cast<int>(chunk)) != 1) {
+            OPENSSL_cleanse(plaintext.data(), plaintext.size());
+            return Result<std::string, std::string>::Err("decryption failed");
+        }
+        written += static_cast<std::size_t>(out_len);
+    }
+
+    int final_len = 0;
+    if (EVP_CIPHER_CTX_ctrl(ctx.get(), EVP_CTRL_GCM_SET_TAG, static_cast<int>(sizeof(tag)), tag) != 1 ||
+        EVP_DecryptFinal_ex(ctx.get(), out + written, &final_len) != 1) {
+        OPENSSL_cleanse(plaintext.data(), plaintext.size());
+        return Result<std::string, std::string>::Err("authentication failed: wrong key or tampered data");
+    }
+
+    return Result<std::string, std::string>::Ok(std::move(plaintext));
+}
+
+Result<ConfidentialPayload, std::string> encode_confidential_payload(const std::string& data, const std::string& key_hex,
+                                                                     const std::string& id_prefix,
+                                                                     const std::string& id_suffix) {
+    // Derive the JSON frame around "Data" from the same serializer submit_certificate uses.
+    // Hex digits never need escaping, so the frame is the dump of an empty "Data" split
+    // between its two quotes.
+    nlohmann::json frame = {
+        {"Action", "CP_CERTIFICATE"},
+        {"Data", ""}
+    };
+    std::string frame_json = frame.dump();
+    std::size_t split = frame_json.rfind("\"\"") + 1;
+    std::string head_hex = str_to_hex(frame_json.substr(0, split));
+    std::string tail_hex = str_to_hex(frame_json.substr(split));
+
+    DigestCtxPtr md(EVP_MD_CTX_new());
+    if (!md || EVP_DigestInit_ex(md.get(), EVP_sha256(), nullptr) != 1) {
+        return Result<ConfidentialPayload, std::string>::Err("failed to initialize SHA-256");
+    }
+
+    ConfidentialPayload encoded;
+    std::string& payload = encoded.payload;
+    payload.reserve(head_hex.size() + 4 * (CONFIDENTIAL_NONCE_SIZE + data.size() + CONFIDENTIAL_TAG_SIZE) + tail_hex.size());
+    payload += head_hex;
+    if (EVP_DigestUpdate(md.get(), id_prefix.data(), id_prefix.size()) != 1 ||
+        EVP_DigestUpdate(md.get(), head_hex.data(), head_hex.size()) != 1) {
+        return Result<ConfidentialPayload, std::string>::Err("failed to compute transaction ID");
+    }
+
+    // Every envelope byte becomes two inner hex digits, each of which becomes two
+    // outer hex digits; hash the freshly written span while it is still in cache.
+    auto result = encrypt_confidential_stream(data, key_hex, [&payload, &md](const unsigned char* bytes, std::size_t length) {
+        std::size_t pos = payload.size();
+        payload.resize(pos + 4 * length);
+        char* p = payload.data() + pos;
+        for (std::size_t i = 0; i < length; ++i) {
+            auto hi = static_cast<unsigned char>(UPPER_HEX[bytes[i] >> 4]);
+            auto lo = static_cast<unsigned char>(UPPER_HEX[bytes[i] & 0x0F]);
+            *p++ = UPPER_HEX[hi >> 4];
+            *p++ = UPPER_HEX[hi & 0x0F];
+            *p++ = UPPER_HEX[lo >> 4];
+            *p++ = UPPER_HEX[lo & 0x0F];
+        }
+        return EVP_DigestUpdate(md.get(), payload.data() + pos, 4 * length) == 1;
+    });
+    if (!result.has_value()) {
+        return Result<ConfidentialPayload, std::string>::Err(result.error());
+    }
+
+    payload += tail_hex;
+    if (EVP_DigestUpdate(md.get(), tail_hex.data(), tail_hex.size()) != 1 ||
+        EVP_DigestUpdate(md.get(), id_suffix.data(), id_suffix.size()) != 1) {
+        return Result<ConfidentialPayload, std::string>::Err("failed to compute transaction ID");
+    }
+
+    unsigned char hash[EVP_MAX_MD_SIZE];
+    unsigned int hash_len = 0;
+    if (EVP_DigestFinal_ex(md.get(), hash, &hash_len) != 1) {
+        return Result<ConfidentialPayload, std::string>::Err("failed to compute transaction ID");
+    }
+
+    encoded.id.reserve(2 * hash_len);
+    for (unsigned int i = 0; i < hash_len; ++i) {
+        encoded.id.push_back(LOWER_HEX[hash[i] >> 4]);
+        encoded.id.push_back(LOWER_HEX[hash[i] & 0x0F]);
+    }
+
+    return Result<ConfidentialPayload, std::string>::Ok(std::move(encoded));
+}
+
+} // namespace circular
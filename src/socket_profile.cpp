@@ -0,0 +1,175 @@
+#include <circular/socket_profile.hpp>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
+namespace circular {
+
+namespace {
+    /// @brief Sets an integer socket option
+    /// @param sock The socket to configure
+    /// @param level The protocol level (SOL_SOCKET, IPPROTO_TCP)
+    /// @param name The option name
+    /// @param value The option value
+    /// @return true if setsockopt succeeded
+    bool set_option(native_socket_t sock, int level, int name, int value) {
+#ifdef _WIN32
+        return setsockopt(static_cast<SOCKET>(sock), level, name,
+                          reinterpret_cast<const char*>(&value), sizeof(value)) == 0;
+#else
+        return setsockopt(sock, level, name, &value, sizeof(value)) == 0;
+#endif
+    }
+
+    /// @brief Reads an integer socket option
+    /// @param sock The socket to query
+    /// @param level The protocol level (SOL_SOCKET, IPPROTO_TCP)
+    /// @param name The option name
+    /// @param value Output parameter for the option value
+    /// @return true if getsockopt succeeded
+    bool get_option(native_socket_t sock, int level, int name, int& value) {
+#ifdef _WIN32
+        int length = sizeof(value);
+        return getsockopt(static_cast<SOCKET>(sock), level, name,
+                          reinterpret_cast<char*>(&value), &length) == 0;
+#else
+        socklen_t length = sizeof(value);
+        return getsockopt(sock, level, name, &value, &length) == 0;
+#endif
+    }
+
+    /// @brief Sets a socket buffer size and checks that the kernel did not cap it
+    /// @param sock The socket to configure
+    /// @param name SO_SNDBUF or SO_RCVBUF
+    /// @param bytes The requested size in bytes
+    /// @return true if the kernel stored the full requested size
+    bool set_buffer(native_socket_t sock, int name, int bytes) {
+        int effective = 0;
+        if (!set_option(sock, SOL_SOCKET, name, bytes) || !get_option(sock, SOL_SOCKET, name, effective)) {
+            return false;
+        }
+#ifdef __linux__
+        // Linux silently caps the size at net.core.{w,r}mem_max and then doubles
+        // it for bookkeeping overhead, so an uncapped request reads back doubled
+        return static_cast<std::int64_t>(effective) >= 2 * static_cast<std::int64_t>(bytes);
+#else
+        return effective >= bytes;
+#endif
+    }
+
+    /// @brief Records a skipped option
+    /// @param skipped_options The list to append to, may be null
+    /// @param name The option name
+    void note_skipped(std::string* skipped_options, const char* name) {
+        if (!skipped_options) {
+            return;
+        }
+        if (!skipped_options->empty()) {
+            *skipped_options += ", ";
+        }
+        *skipped_options += name;
+    }
+}
+
+SocketSettings SocketSettings::for_profile(SocketProfile profile) {
+    SocketSettings settings;
+
+    // Buffers stay at 0 so the kernel keeps autotuning them; busy polling and
+    // keepalive have no effect on the per-request connections of the transport
+    switch (profile) {
+    case SocketProfile::Default:
+        break;
+
+    case SocketProfile::Throughput:
+        settings.tcp_fast_open = true;
+        break;
+
+    case SocketProfile::LowLatency:
+        settings.tcp_nodelay = true;
+        settings.tcp_fast_open = true;
+        break;
+    }
+
+    return settings;
+}
+
+bool apply_socket_settings(native_socket_t sock, const SocketSettings& settings, std::string* skipped_options) {
+    bool all_applied = true;
+    auto check = [&all_applied, skipped_options](bool applied, const char* name) {
+        if (!applied) {
+            all_applied = false;
+            note_skipped(skipped_options, name);
+        }
+    };
+
+    if (settings.tcp_nodelay) {
+        check(set_option(sock, IPPROTO_TCP, TCP_NODELAY, 1), "tcp_nodelay");
+    }
+
+    if (settings.tcp_fast_open) {
+#ifdef TCP_FASTOPEN_CONNECT
+        // connect() returns immediately and the first write goes out in the SYN
+        // once the kernel holds a cookie for the peer
+        check(set_option(sock, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, 1), "tcp_fast_open");
+#else
+        // Other platforms only offer Fast Open through dedicated connect calls
+        check(false, "tcp_fast_open");
+#endif
+    }
+
+    if (settings.send_buffer_bytes > 0) {
+        check(set_buffer(sock, SO_SNDBUF, settings.send_buffer_bytes), "send_buffer_bytes");
+    }
+
+    if (settings.receive_buffer_bytes > 0) {
+        check(set_buffer(sock, SO_RCVBUF, settings.receive_buffer_bytes), "receive_buffer_bytes");
+    }
+
+    if (settings.busy_poll_usec > 0) {
+#ifdef SO_BUSY_POLL
+        check(set_option(sock, SOL_SOCKET, SO_BUSY_POLL, settings.busy_poll_usec), "busy_poll_usec");
+#else
+        check(false, "busy_poll_usec");
+#endif
+    }
+
+    if (settings.keepalive) {
+        check(set_option(sock, SOL_SOCKET, SO_KEEPALIVE, 1), "keepalive");
+
+        if (settings.keepalive_idle_sec > 0) {
+#if defined(TCP_KEEPIDLE)
+            check(set_option(sock, IPPROTO_TCP, TCP_KEEPIDLE, settings.keepalive_idle_sec), "keepalive_idle_sec");
+#elif defined(TCP_KEEPALIVE)
+            check(set_option(sock, IPPROTO_TCP, TCP_KEEPALIVE, settings.keepalive_idle_sec), "keepalive_idle_sec");
+#else
+            check(false, "keepalive_idle_sec");
+#endif
+        }
+
+        if (settings.keepalive_interval_sec > 0) {
+#ifdef TCP_KEEPINTVL
+            check(set_option(sock, IPPROTO_TCP, TCP_KEEPINTVL, settings.keepalive_interval_sec), "keepalive_interval_sec");
+#else
+            check(false, "keepalive_interval_sec");
+#endif
+        }
+
+        if (settings.keepalive_count > 0) {
+#ifdef TCP_KEEPCNT
+            check(set_option(sock, IPPROTO_TCP, TCP_KEEPCNT, settings.keepalive_count), "keepalive_count");
+#else
+            check(false, "keepalive_count");
+#endif
+        }
+    }
+
+    return all_applied;
+}
+
+} // namespace circular
@@ -49,6 +49,44 @@ TEST_CASE("Testing CCertificate data operations") {
     }
 }
 
+TEST_CASE("Testing CCertificate confidential data") {
+    CCertificate cert;
+    const std::string key = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f";
+
+    SUBCASE("Set and get confidential data") {
+        std::string test_data = "Confidential: !@#$%^&*()\n";
+        CHECK(cert.set_confidential_data(test_data, key));
+
+        auto decrypted = cert.get_confidential_data(key);
+        REQUIRE(decrypted.has_value());
+        CHECK(decrypted.value() == test_data);
+    }
+
+    SUBCASE("JSON holds the hex envelope, not the plaintext") {
+        CHECK(cert.set_confidential_data("Hello", key));
+
+        auto json = nlohmann::json::parse(cert.get_json_certificate());
+        std::string data = json["data"];
+        CHECK(data != "48656C6C6F");
+        CHECK(data.length() == 2 * (CONFIDENTIAL_NONCE_SIZE + 5 + CONFIDENTIAL_TAG_SIZE));
+        CHECK(json.size() == 4);
+    }
+
+    SUBCASE("Invalid key leaves data unchanged") {
+        cert.set_data("plain");
+        CHECK_FALSE(cert.set_confidential_data("secret", "abcd"));
+        CHECK(cert.get_data() == "plain");
+    }
+
+    SUBCASE("Wrong key or plain data fails") {
+        CHECK(cert.set_confidential_data("secret", key));
+        CHECK_FALSE(cert.get_confidential_data(std::string(64, 'f')).has_value());
+
+        cert.set_data("plain");
+        CHECK_FALSE(cert.get_confidential_data(key).has_value());
+    }
+}
+
 TEST_CASE("Testing CCertificate previous transaction operations") {
     CCertificate cert;
 
@@ -19,10 +19,33 @@ TEST_CASE("Testing CepAccount constructor") {
         CHECK(account.nonce == 0);
         CHECK(account.interval_sec == 2);
         CHECK(account.network_url == DEFAULT_NETWORK_URL);
+        CHECK_FALSE(account.socket_settings.tcp_nodelay);
+        CHECK_FALSE(account.socket_settings.tcp_fast_open);
+        CHECK(!account.get_socket_warning().has_value());
         CHECK(!account.get_last_error().has_value());
     }
 }
 
+TEST_CASE("Testing CepAccount socket profile") {
+    CepAccount account;
+
+    SUBCASE("Low-latency profile") {
+        account.set_socket_profile(SocketProfile::LowLatency);
+        CHECK(account.socket_settings.tcp_nodelay);
+        CHECK(account.socket_settings.tcp_fast_open);
+        CHECK(account.socket_settings.busy_poll_usec == 0);
+        CHECK_FALSE(account.socket_settings.keepalive);
+    }
+
+    SUBCASE("Back to default profile") {
+        account.set_socket_profile(SocketProfile::LowLatency);
+        account.set_socket_profile(SocketProfile::Default);
+        CHECK_FALSE(account.socket_settings.tcp_nodelay);
+        CHECK_FALSE(account.socket_settings.tcp_fast_open);
+        CHECK(account.socket_settings.busy_poll_usec == 0);
+    }
+}
+
 TEST_CASE("Testing CepAccount open/close operations") {
     CepAccount account;
 
@@ -0,0 +1,175 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <circular/confidential.hpp>
+#include <circular/utils.hpp>
+#include <nlohmann/json.hpp>
+#include <openssl/sha.h>
+#include <cctype>
+#include <iomanip>
+#include <sstream>
+
+using namespace circular;
+
+namespace {
+    const std::string TEST_KEY = "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f";
+    const std::string OTHER_KEY = "1f1e1d1c1b1a191817161514131211100f0e0d0c0b0a09080706050403020100";
+
+    std::string sha256_hex(const std::string& data) {
+        unsigned char hash[SHA256_DIGEST_LENGTH];
+        SHA256(reinterpret_cast<const unsigned char*>(data.data()), data.size(), hash);
+        std::ostringstream oss;
+        for (unsigned char byte : hash) {
+            oss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte);
+        }
+        return oss.str();
+    }
+}
+
+TEST_CASE("Testing generate_confidential_key") {
+    std::string key1 = generate_confidential_key();
+    std::string key2 = generate_confidential_key();
+
+    CHECK(key1.length() == 2 * CONFIDENTIAL_KEY_SIZE);
+    CHECK(key1 != key2);
+    CHECK(encrypt_confidential("data", key1).has_value());
+}
+
+TEST_CASE("Testing encrypt_confidential / decrypt_confidential round trip") {
+    SUBCASE("Short text") {
+        auto encrypted = encrypt_confidential("Hello, World!", TEST_KEY);
+        REQUIRE(encrypted.has_value());
+        CHECK(encrypted.value().length() == 2 * (CONFIDENTIAL_NONCE_SIZE + 13 + CONFIDENTIAL_TAG_SIZE));
+
+        auto decrypted = decrypt_confidential(encrypted.value(), TEST_KEY);
+        REQUIRE(decrypted.has_value());
+        CHECK(decrypted.value() == "Hello, World!");
+    }
+
+    SUBCASE("Empty data") {
+        auto encrypted = encrypt_confidential("", TEST_KEY);
+        REQUIRE(encrypted.has_value());
+        CHECK(encrypted.value().length() == 2 * (CONFIDENTIAL_NONCE_SIZE + CONFIDENTIAL_TAG_SIZE));
+
+        auto decrypted = decrypt_confidential(encrypted.value(), TEST_KEY);
+        REQUIRE(decrypted.has_value());
+        CHECK(decrypted.value() == "");
+    }
+
+    SUBCASE("Data spanning several chunks with binary bytes") {
+        std::string data;
+        for (int i = 0; i < 100000; ++i) {
+            data.push_back(static_cast<char>(i % 256));
+        }
+        auto encrypted = encrypt_confidential(data, TEST_KEY);
+        REQUIRE(encrypted.has_value());
+
+        auto decrypted = decrypt_confidential(encrypted.value(), TEST_KEY);
+        REQUIRE(decrypted.has_value());
+        CHECK(decrypted.value() == data);
+    }
+
+    SUBCASE("Key and envelope accept 0x prefix and either case") {
+        auto encrypted = encrypt_confidential("prefixed", "0x" + TEST_KEY);
+        REQUIRE(encrypted.has_value());
+
+        std::string lower = encrypted.value();
+        for (auto& c : lower) {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        auto decrypted = decrypt_confidential("0x" + lower, TEST_KEY);
+        REQUIRE(decrypted.has_value());
+        CHECK(decrypted.value() == "prefixed");
+    }
+
+    SUBCASE("Fresh nonce per encryption") {
+        auto first = encrypt_confidential("same", TEST_KEY);
+        auto second = encrypt_confidential("same", TEST_KEY);
+        REQUIRE(first.has_value());
+        REQUIRE(second.has_value());
+        CHECK(first.value() != second.value());
+    }
+}
+
+TEST_CASE("Testing confidential error handling") {
+    auto encrypted = encrypt_confidential("secret", TEST_KEY);
+    REQUIRE(encrypted.has_value());
+
+    SUBCASE("Invalid key") {
+        CHECK_FALSE(encrypt_confidential("secret", "").has_value());
+        CHECK_FALSE(encrypt_confidential("secret", "abcd").has_value());
+        CHECK_FALSE(encrypt_confidential("secret", std::string(64, 'g')).has_value());
+        CHECK_FALSE(encrypt_confidential("secret", TEST_KEY.substr(1)).has_value());
+        CHECK_FALSE(encrypt_confidential("secret", "0x" + TEST_KEY.substr(1)).has_value());
+        CHECK_FALSE(encrypt_confidential("secret", TEST_KEY + "0").has_value());
+        CHECK_FALSE(decrypt_confidential(encrypted.value(), "abcd").has_value());
+    }
+
+    SUBCASE("Sink returning false aborts encryption") {
+        std::size_t calls = 0;
+        auto result = encrypt_confidential_stream("secret", TEST_KEY, [&calls](const unsigned char*, std::size_t) {
+            ++calls;
+            return false;
+        });
+        CHECK_FALSE(result.has_value());
+        CHECK(calls == 1);
+    }
+
+    SUBCASE("Wrong key fails authentication") {
+        auto decrypted = decrypt_confidential(encrypted.value(), OTHER_KEY);
+        CHECK_FALSE(decrypted.has_value());
+    }
+
+    SUBCASE("Tampered ciphertext fails authentication") {
+        std::string tampered = encrypted.value();
+        std::size_t pos = 2 * CONFIDENTIAL_NONCE_SIZE;
+        tampered[pos] = tampered[pos] == '0' ? '1' : '0';
+        CHECK_FALSE(decrypt_confidential(tampered, TEST_KEY).has_value());
+    }
+
+    SUBCASE("Malformed envelope") {
+        CHECK_FALSE(decrypt_confidential("", TEST_KEY).has_value());
+        CHECK_FALSE(decrypt_confidential("ABC", TEST_KEY).has_value());
+        CHECK_FALSE(decrypt_confidential(std::string(2 * CONFIDENTIAL_NONCE_SIZE, 'A'), TEST_KEY).has_value());
+
+        std::string bad_hex = encrypted.value();
+        bad_hex[2 * CONFIDENTIAL_NONCE_SIZE] = 'Z';
+        CHECK_FALSE(decrypt_confidential(bad_hex, TEST_KEY).has_value());
+    }
+}
+
+TEST_CASE("Testing encode_confidential_payload") {
+    std::string prefix = "chainfromto";
+    std::string suffix = "12026:10:18-12:00:00";
+    std::string document = "Confidential document contents";
+
+    auto encoded = encode_confidential_payload(document, TEST_KEY, prefix, suffix);
+    REQUIRE(encoded.has_value());
+
+    SUBCASE("Payload matches the regular double hex encoding") {
+        auto payload_object = nlohmann::json::parse(hex_to_str(encoded.value().payload));
+        CHECK(payload_object.size() == 2);
+        CHECK(payload_object["Action"] == "CP_CERTIFICATE");
+
+        std::string envelope_hex = payload_object["Data"];
+        nlohmann::json expected = {
+            {"Action", "CP_CERTIFICATE"},
+            {"Data", envelope_hex}
+        };
+        CHECK(encoded.value().payload == str_to_hex(expected.dump()));
+    }
+
+    SUBCASE("Data field decrypts to the document") {
+        auto payload_object = nlohmann::json::parse(hex_to_str(encoded.value().payload));
+        auto decrypted = decrypt_confidential(payload_object["Data"].get<std::string>(), TEST_KEY);
+        REQUIRE(decrypted.has_value());
+        CHECK(decrypted.value() == document);
+    }
+
+    SUBCASE("ID is the SHA-256 of prefix, payload and suffix") {
+        CHECK(encoded.value().id == sha256_hex(prefix + encoded.value().payload + suffix));
+    }
+
+    SUBCASE("Invalid key") {
+        CHECK_FALSE(encode_confidential_payload(document, "abcd", prefix, suffix).has_value());
+    }
+}
@@ -0,0 +1,168 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <circular/socket_profile.hpp>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <climits>
+#include <fstream>
+#endif
+
+using namespace circular;
+
+namespace {
+#ifndef _WIN32
+    /// @brief Reads an integer socket option, failing the test if getsockopt fails
+    int get_option(int sock, int level, int name) {
+        int value = 0;
+        socklen_t length = sizeof(value);
+        REQUIRE(getsockopt(sock, level, name, &value, &length) == 0);
+        return value;
+    }
+
+#ifdef __linux__
+    /// @brief Reads an integer sysctl from /proc, returning -1 if unavailable
+    int read_sysctl(const char* path) {
+        std::ifstream sysctl(path);
+        int value = -1;
+        if (!(sysctl >> value)) {
+            return -1;
+        }
+        return value;
+    }
+#endif
+#endif
+}
+
+TEST_CASE("Testing SocketSettings profiles") {
+    SUBCASE("Default settings change nothing") {
+        SocketSettings settings;
+        CHECK_FALSE(settings.tcp_nodelay);
+        CHECK_FALSE(settings.tcp_fast_open);
+        CHECK(settings.send_buffer_bytes == 0);
+        CHECK(settings.receive_buffer_bytes == 0);
+        CHECK(settings.busy_poll_usec == 0);
+        CHECK_FALSE(settings.keepalive);
+
+        SocketSettings profile = SocketSettings::for_profile(SocketProfile::Default);
+        CHECK_FALSE(profile.tcp_nodelay);
+        CHECK_FALSE(profile.tcp_fast_open);
+        CHECK(profile.busy_poll_usec == 0);
+    }
+
+    SUBCASE("Low-latency profile") {
+        SocketSettings settings = SocketSettings::for_profile(SocketProfile::LowLatency);
+        CHECK(settings.tcp_nodelay);
+        CHECK(settings.tcp_fast_open);
+        CHECK(settings.busy_poll_usec == 0);
+        CHECK_FALSE(settings.keepalive);
+    }
+
+    SUBCASE("Throughput profile keeps buffer autotuning") {
+        SocketSettings settings = SocketSettings::for_profile(SocketProfile::Throughput);
+        CHECK_FALSE(settings.tcp_nodelay);
+        CHECK(settings.tcp_fast_open);
+        CHECK(settings.send_buffer_bytes == 0);
+        CHECK(settings.receive_buffer_bytes == 0);
+        CHECK_FALSE(settings.keepalive);
+    }
+}
+
+#ifndef _WIN32
+TEST_CASE("Testing apply_socket_settings") {
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    REQUIRE(sock >= 0);
+
+    SUBCASE("Default settings leave the socket untouched") {
+        std::string skipped;
+        CHECK(apply_socket_settings(sock, SocketSettings{}, &skipped));
+        CHECK(skipped.empty());
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_NODELAY) == 0);
+        CHECK(get_option(sock, SOL_SOCKET, SO_KEEPALIVE) == 0);
+    }
+
+    SUBCASE("Individual options are applied") {
+        SocketSettings settings;
+        settings.tcp_nodelay = true;
+        settings.send_buffer_bytes = 128 * 1024;
+        settings.keepalive = true;
+        settings.keepalive_idle_sec = 45;
+        settings.keepalive_interval_sec = 7;
+        settings.keepalive_count = 4;
+
+        std::string skipped;
+        CHECK(apply_socket_settings(sock, settings, &skipped));
+        CHECK(skipped.empty());
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_NODELAY) != 0);
+        CHECK(get_option(sock, SOL_SOCKET, SO_SNDBUF) >= 128 * 1024);
+        CHECK(get_option(sock, SOL_SOCKET, SO_KEEPALIVE) != 0);
+#ifdef TCP_KEEPIDLE
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_KEEPIDLE) == 45);
+#endif
+#ifdef TCP_KEEPINTVL
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_KEEPINTVL) == 7);
+#endif
+#ifdef TCP_KEEPCNT
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_KEEPCNT) == 4);
+#endif
+    }
+
+    SUBCASE("Low-latency profile") {
+        std::string skipped;
+        bool applied = apply_socket_settings(sock, SocketSettings::for_profile(SocketProfile::LowLatency), &skipped);
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_NODELAY) != 0);
+#ifdef TCP_FASTOPEN_CONNECT
+        CHECK(applied);
+        CHECK(skipped.empty());
+        CHECK(get_option(sock, IPPROTO_TCP, TCP_FASTOPEN_CONNECT) == 1);
+#else
+        CHECK_FALSE(applied);
+        CHECK(skipped == "tcp_fast_open");
+#endif
+    }
+
+#ifdef __linux__
+    SUBCASE("Buffer just above the kernel cap is reported") {
+        // Linux reports double the stored size, so a request slightly above
+        // wmem_max still reads back larger than requested
+        int wmem_max = read_sysctl("/proc/sys/net/core/wmem_max");
+        REQUIRE(wmem_max > 0);
+        REQUIRE(wmem_max < INT_MAX);
+
+        SocketSettings settings;
+        settings.send_buffer_bytes = wmem_max + 1;
+
+        std::string skipped;
+        CHECK_FALSE(apply_socket_settings(sock, settings, &skipped));
+        CHECK(skipped == "send_buffer_bytes");
+    }
+
+    SUBCASE("Buffer at the kernel cap is applied") {
+        int rmem_max = read_sysctl("/proc/sys/net/core/rmem_max");
+        REQUIRE(rmem_max > 0);
+
+        SocketSettings settings;
+        settings.receive_buffer_bytes = rmem_max;
+
+        std::string skipped;
+        CHECK(apply_socket_settings(sock, settings, &skipped));
+        CHECK(skipped.empty());
+    }
+#endif
+
+    SUBCASE("Invalid socket reports failure") {
+        SocketSettings settings;
+        settings.tcp_nodelay = true;
+        settings.keepalive = true;
+
+        std::string skipped;
+        CHECK_FALSE(apply_socket_settings(-1, settings, &skipped));
+        CHECK(skipped == "tcp_nodelay, keepalive");
+    }
+
+    close(sock);
+}
+#endif